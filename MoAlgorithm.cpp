@@ -0,0 +1,140 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/* Mo's Algorithm (Offline Range Queries) Generic Code */
+/*
+- used when answer of [l, r] can't be merged from two halves (distinct count, most frequent value, ...)
+  so Node::merge of Segment Tree / FenwickTree::query can't be used
+- all queries must be known in advance (offline), answers are returned in the input order
+- we only need to know how to add(id) / remove(id) one element to the current window [curL, curR]
+- queries are sorted along a Hilbert curve, so total pointer movement is ~ O((n + q) * sqrt(n))
+*/
+
+// position of the cell (x, y) on the Hilbert curve of a (2^pow x 2^pow) grid
+// nearby queries on the curve have nearby (l, r), so the window moves very little between them
+long long hilbertOrder(int x, int y, int pow, int rotate){
+	if(pow == 0) return 0;
+	int hpow = 1 << (pow - 1);
+	int seg = (x < hpow) ? ((y < hpow) ? 0 : 3) : ((y < hpow) ? 1 : 2);
+	seg = (seg + rotate) & 3;
+	const int rotateDelta[4] = {3, 0, 0, 1};
+	int nx = x & (x ^ hpow), ny = y & (y ^ hpow);
+	int nrot = (rotate + rotateDelta[seg]) & 3;
+	long long subSquareSize = 1LL << (2 * pow - 2);
+	long long ans = seg * subSquareSize;
+	long long add = hilbertOrder(nx, ny, pow - 1, nrot);
+	ans += (seg == 1 || seg == 2) ? add : (subSquareSize - add - 1);
+	return ans;
+}
+
+class MoQuery{
+public:
+	int l, r, id; // [l, r] included, id is position of the query in the input
+	long long ord; // Hilbert order of (l, r)
+	MoQuery(){}
+	MoQuery(int l, int r, int id, int pow){
+		this->l = l;
+		this->r = r;
+		this->id = id;
+		ord = hilbertOrder(l, r, pow, 0);
+	}
+
+	bool operator<(const MoQuery& other) const{
+		return ord < other.ord;
+	}
+};
+
+/*
+- add(id)    : element at index id enters the window
+- remove(id) : element at index id leaves the window
+- answer()   : answer for the current window
+Passing these as template types (lambdas / functors) lets the compiler inline them in the loops below
+*/
+template <typename AnsType, typename AddFn, typename RemoveFn, typename AnswerFn>
+vector<AnsType> moSolve(int n, const vector<pair<int, int>>& queries, AddFn add, RemoveFn remove, AnswerFn answer){
+	int q = queries.size();
+	vector<AnsType> result(q);
+	if(q == 0) return result;
+
+	int pow = 1;
+	while((1 << pow) < n) pow++; // grid must cover all indices 0...n-1
+
+	vector<MoQuery> qs;
+	qs.reserve(q);
+	for(int i=0; i<q; i++){
+		qs.push_back(MoQuery(queries[i].first, queries[i].second, i, pow));
+	}
+	sort(qs.begin(), qs.end());
+
+	int curL = 0, curR = -1; // empty window
+	for(const MoQuery& it : qs){
+		// extend first, then shrink -- so window is never "negative" (curL > curR + 1)
+		while(curL > it.l) add(--curL);
+		while(curR < it.r) add(++curR);
+		while(curL < it.l) remove(curL++);
+		while(curR > it.r) remove(curR--);
+		result[it.id] = answer();
+	}
+	return result;
+}
+
+class Solution{
+public:
+	// same input format as querySum in Segment_Tree_Code_with_mik.cpp (queries are 1 based, 2 values per query)
+	vector<int> querySum(int n, int arr[], int q, int queries[]){
+		vector<pair<int, int>> qs(q);
+		for(int i=0; i<q; i++){
+			qs[i] = {queries[2*i] - 1, queries[2*i+1] - 1};
+		}
+
+		int sum = 0;
+		return moSolve<int>(n, qs,
+			[&](int id){ sum += arr[id]; },
+			[&](int id){ sum -= arr[id]; },
+			[&](){ return sum; });
+	}
+
+	// number of distinct values in each [l, r] (0 based)
+	vector<int> distinctCount(vector<int>& a, vector<pair<int, int>>& queries){
+		int n = a.size();
+		// compress values, so we can use a plain array for frequency
+		vector<int> vals(a.begin(), a.end());
+		sort(vals.begin(), vals.end());
+		vals.erase(unique(vals.begin(), vals.end()), vals.end());
+		vector<int> c(n);
+		for(int i=0; i<n; i++) c[i] = lower_bound(vals.begin(), vals.end(), a[i]) - vals.begin();
+
+		vector<int> freq(vals.size(), 0);
+		int distinct = 0;
+		return moSolve<int>(n, queries,
+			[&](int id){ if(freq[c[id]]++ == 0) distinct++; },
+			[&](int id){ if(--freq[c[id]] == 0) distinct--; },
+			[&](){ return distinct; });
+	}
+};
+
+int main()
+{
+	vector<int> a = {1, 2, 1, 4, 2, 3, 1, 1};
+	int n = a.size();
+
+	Solution sol;
+
+	// Distinct elements in range
+	vector<pair<int, int>> queries = {{0, 7}, {1, 4}, {2, 2}, {3, 6}, {0, 2}};
+	vector<int> distinct = sol.distinctCount(a, queries);
+	for(int i=0; i<(int)queries.size(); i++){
+		cout<< "Distinct elements in range [" <<queries[i].first<< ", " <<queries[i].second<< "]: " <<distinct[i]<<endl;
+	}
+	cout<<endl;
+
+	// Range Sum -- querySum style batch API
+	int q = 3;
+	int qArr[] = {2, 6, 3, 7, 1, 5}; // 1 based
+	vector<int> sums = sol.querySum(n, a.data(), q, qArr);
+	for(int i=0; i<q; i++){
+		cout<< "Sum of elements in range [" <<qArr[2*i]<< ", " <<qArr[2*i+1]<< "]: " <<sums[i]<<endl;
+	}
+
+	return 0;
+}